@@ -23,211 +23,1225 @@
 
 #include <sys/stat.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+
+#define JERRY_PORT_HAVE_MMAP
+#endif /* defined(__unix__) || defined(__APPLE__) */
+
 #ifndef S_ISDIR
 #define S_ISDIR(mode) (((mode) &S_IFMT) == S_IFDIR)
 #endif /* !defined(S_ISDIR) */
 
+#ifndef PATH_MAX
+#define PATH_MAX 4096
+#endif /* !defined(PATH_MAX) */
+
+#ifdef JERRY_PORT_HAVE_MMAP
+
+/**
+ * Maximum number of concurrently memory mapped source files.
+ */
+#define JERRY_PORT_SOURCE_MAPPING_COUNT 8
+
+/**
+ * A memory mapped source file.
+ */
+typedef struct
+{
+  uint8_t *base_p; /**< start of the mapping, NULL if the slot is unused */
+  size_t size; /**< length of the mapping */
+} jerry_port_source_mapping_t;
+
+/**
+ * Registry of active source file mappings, consulted by jerry_port_release_source.
+ */
+static jerry_port_source_mapping_t jerry_port_source_mappings[JERRY_PORT_SOURCE_MAPPING_COUNT];
+
+/**
+ * Maps the given file into memory for reading.
+ *
+ * The parser reads the bytes straight from the page cache, so no intermediate
+ * heap buffer or copy is needed.
+ *
+ * @return pointer to the mapped source if the operation is successful,
+ *         NULL otherwise (the caller should fall back to buffered reading)
+ */
+static uint8_t *
+jerry_port_map_source (const char *file_name_p, /**< file name */
+                       size_t *out_size_p) /**< [out] number of mapped bytes */
+{
+  jerry_port_source_mapping_t *mapping_p = NULL;
+
+  for (size_t i = 0; i < JERRY_PORT_SOURCE_MAPPING_COUNT; i++)
+  {
+    if (jerry_port_source_mappings[i].base_p == NULL)
+    {
+      mapping_p = &jerry_port_source_mappings[i];
+      break;
+    }
+  }
+
+  if (mapping_p == NULL)
+  {
+    return NULL;
+  }
+
+  int fd = open (file_name_p, O_RDONLY);
+
+  if (fd == -1)
+  {
+    return NULL;
+  }
+
+  struct stat stat_buffer;
+
+  if (fstat (fd, &stat_buffer) == -1 || !S_ISREG (stat_buffer.st_mode) || stat_buffer.st_size <= 0)
+  {
+    close (fd);
+    return NULL;
+  }
+
+  size_t file_size = (size_t) stat_buffer.st_size;
+
+  /* The mapping is private copy-on-write: callers of jerry_port_read_source
+   * receive a writable buffer (snapshot loading patches it in place), and
+   * only the pages actually written are copied. */
+  void *base_p = mmap (NULL, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close (fd);
+
+  if (base_p == MAP_FAILED)
+  {
+    return NULL;
+  }
+
+#ifdef MADV_SEQUENTIAL
+  madvise (base_p, file_size, MADV_SEQUENTIAL | MADV_WILLNEED);
+#endif /* MADV_SEQUENTIAL */
+
+  mapping_p->base_p = (uint8_t *) base_p;
+  mapping_p->size = file_size;
+
+  *out_size_p = file_size;
+  return (uint8_t *) base_p;
+} /* jerry_port_map_source */
+
+#endif /* JERRY_PORT_HAVE_MMAP */
+
+#if !defined(__unix__) && !defined(__APPLE__)
+
+/**
+ * Determines the size of the given file.
+ * @return size of the file
+ */
+static size_t
+jerry_port_get_file_size (FILE *file_p) /**< opened file */
+{
+  fseek (file_p, 0, SEEK_END);
+  long size = ftell (file_p);
+  fseek (file_p, 0, SEEK_SET);
+
+  return (size_t) size;
+} /* jerry_port_get_file_size */
+
+#endif /* !defined(__unix__) && !defined(__APPLE__) */
+
+/**
+ * Opens file with the given path and reads its source.
+ * @return the source of the file
+ */
+uint8_t *
+jerry_port_read_source (const char *file_name_p, /**< file name */
+                        size_t *out_size_p) /**< [out] read bytes */
+{
+#ifdef JERRY_PORT_HAVE_MMAP
+  uint8_t *mapped_p = jerry_port_map_source (file_name_p, out_size_p);
+
+  if (mapped_p != NULL)
+  {
+    return mapped_p;
+  }
+#endif /* JERRY_PORT_HAVE_MMAP */
+
+#if defined(__unix__) || defined(__APPLE__)
+  /* A single open + fstat resolves the pathname once, instead of the
+   * separate stat + fopen pair walking the directory tree twice. */
+  int fd = open (file_name_p, O_RDONLY | O_CLOEXEC);
+
+  if (fd == -1)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to open file: %s\n", file_name_p);
+    return NULL;
+  }
+
+  struct stat stat_buffer;
+
+  if (fstat (fd, &stat_buffer) == -1 || S_ISDIR (stat_buffer.st_mode))
+  {
+    close (fd);
+
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to open file: %s\n", file_name_p);
+    return NULL;
+  }
+
+  FILE *file_p = fdopen (fd, "rb");
+
+  if (file_p == NULL)
+  {
+    close (fd);
+
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to open file: %s\n", file_name_p);
+    return NULL;
+  }
+
+  size_t file_size = (size_t) stat_buffer.st_size;
+#else /* !defined(__unix__) && !defined(__APPLE__) */
+  struct stat stat_buffer;
+  if (stat (file_name_p, &stat_buffer) == -1 || S_ISDIR (stat_buffer.st_mode))
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to open file: %s\n", file_name_p);
+    return NULL;
+  }
+
+  FILE *file_p = fopen (file_name_p, "rb");
+
+  if (file_p == NULL)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to open file: %s\n", file_name_p);
+    return NULL;
+  }
+
+  size_t file_size = jerry_port_get_file_size (file_p);
+#endif /* defined(__unix__) || defined(__APPLE__) */
+  uint8_t *buffer_p = (uint8_t *) malloc (file_size);
+
+  if (buffer_p == NULL)
+  {
+    fclose (file_p);
+
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to allocate memory for file: %s\n", file_name_p);
+    return NULL;
+  }
+
+#if defined(_POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0)
+  /* The file is read front-to-back exactly once: widen the readahead
+   * window up front and drop the pages from the cache afterwards. */
+  posix_fadvise (fileno (file_p), 0, (off_t) file_size, POSIX_FADV_SEQUENTIAL);
+  posix_fadvise (fileno (file_p), 0, (off_t) file_size, POSIX_FADV_WILLNEED);
+#endif /* defined(_POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0) */
+
+  size_t bytes_read = fread (buffer_p, 1u, file_size, file_p);
+
+#if defined(_POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0)
+  posix_fadvise (fileno (file_p), 0, (off_t) file_size, POSIX_FADV_DONTNEED);
+#endif /* defined(_POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0) */
+
+  if (bytes_read != file_size)
+  {
+    fclose (file_p);
+    free (buffer_p);
+
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to read file: %s\n", file_name_p);
+    return NULL;
+  }
+
+  fclose (file_p);
+  *out_size_p = bytes_read;
+
+  return buffer_p;
+} /* jerry_port_read_source */
+
+/**
+ * Release the previously opened file's content.
+ */
+void
+jerry_port_release_source (uint8_t *buffer_p) /**< buffer to free */
+{
+#ifdef JERRY_PORT_HAVE_MMAP
+  for (size_t i = 0; i < JERRY_PORT_SOURCE_MAPPING_COUNT; i++)
+  {
+    if (jerry_port_source_mappings[i].base_p == buffer_p)
+    {
+      munmap (jerry_port_source_mappings[i].base_p, jerry_port_source_mappings[i].size);
+      jerry_port_source_mappings[i].base_p = NULL;
+      return;
+    }
+  }
+#endif /* JERRY_PORT_HAVE_MMAP */
+
+  free (buffer_p);
+} /* jerry_port_release_source */
+
+/**
+ * Checks whether the given character is a path separator.
+ *
+ * @return true if the character separates path components, false otherwise
+ */
+static bool
+jerry_port_path_is_separator (jerry_char_t chr) /**< character to check */
+{
+#if defined(_WIN32)
+  return chr == '/' || chr == '\\';
+#else /* !_WIN32 */
+  return chr == '/';
+#endif /* _WIN32 */
+} /* jerry_port_path_is_separator */
+
+/**
+ * Builds a SWAR mask with the high bit set in every byte of the word that
+ * matches the separator broadcast into sep_broadcast.
+ *
+ * @return separator match mask
+ */
+static uint64_t
+jerry_port_path_separator_mask (uint64_t chunk, /**< eight path bytes */
+                                uint64_t sep_broadcast) /**< separator repeated in every byte */
+{
+  uint64_t diff = chunk ^ sep_broadcast;
+  return (diff - 0x0101010101010101ull) & ~diff & 0x8080808080808080ull;
+} /* jerry_port_path_separator_mask */
+
+/**
+ * Computes the end of the directory part of a path.
+ *
+ * The path is scanned backwards eight bytes at a time: a whole word is tested
+ * for separators with the SWAR zero-byte trick, and only a word that contains
+ * one is examined byte by byte.
+ *
+ * @return end of the directory part of a path.
+ */
+static size_t
+jerry_port_get_directory_end (const jerry_char_t *path_p, /**< path */
+                              size_t path_length) /**< length of the path */
+{
+  size_t index = path_length;
+
+  while (index >= sizeof (uint64_t))
+  {
+    uint64_t chunk;
+    memcpy (&chunk, path_p + index - sizeof (uint64_t), sizeof (uint64_t));
+
+    uint64_t match = jerry_port_path_separator_mask (chunk, 0x2f2f2f2f2f2f2f2full);
+
+#if defined(_WIN32)
+    match |= jerry_port_path_separator_mask (chunk, 0x5c5c5c5c5c5c5c5cull);
+#endif /* _WIN32 */
+
+    if (match != 0)
+    {
+      /* The word is known to contain a separator. */
+      while (!jerry_port_path_is_separator (path_p[index - 1]))
+      {
+        index--;
+      }
+
+      return index;
+    }
+
+    index -= sizeof (uint64_t);
+  }
+
+  while (index > 0)
+  {
+    if (jerry_port_path_is_separator (path_p[index - 1]))
+    {
+      return index;
+    }
+
+    index--;
+  }
+
+  return 0;
+} /* jerry_port_get_directory_end */
+
+#if defined(__unix__) || defined(__APPLE__)
+
+/**
+ * Checks whether a path qualifies for lexical canonicalization: absolute,
+ * plain ASCII and free of home directory shorthands.
+ *
+ * @return true if the path can be canonicalized without the filesystem,
+ *         false otherwise
+ */
+static bool
+jerry_port_path_is_plain_ascii (const char *path_p, /**< path */
+                                size_t path_length) /**< length of the path */
+{
+  if (path_length == 0 || path_p[0] != '/')
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < path_length; i++)
+  {
+    unsigned char chr = (unsigned char) path_p[i];
+
+    if (chr >= 0x80 || chr == '~')
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* jerry_port_path_is_plain_ascii */
+
+/**
+ * Canonicalizes an absolute path lexically: collapses repeated separators and
+ * resolves "." and ".." components without any filesystem access.
+ *
+ * Unlike realpath, symbolic links are left as-is, which is fine for module
+ * identity as long as the bundle does not reach the same file through
+ * different links.
+ *
+ * @return a newly allocated buffer with the canonical path if the operation is successful,
+ *         NULL otherwise
+ */
+static char *
+jerry_port_canonicalize_path (const char *path_p, /**< absolute path */
+                              size_t path_length, /**< length of the path */
+                              size_t *out_length_p) /**< [out] length of the canonical path */
+{
+  char *out_p = (char *) malloc (path_length + 1);
+
+  if (out_p == NULL)
+  {
+    return NULL;
+  }
+
+  size_t out_length = 0;
+  size_t index = 0;
+
+  while (index < path_length)
+  {
+    while (index < path_length && path_p[index] == '/')
+    {
+      index++;
+    }
+
+    size_t segment_start = index;
+
+    while (index < path_length && path_p[index] != '/')
+    {
+      index++;
+    }
+
+    size_t segment_length = index - segment_start;
+
+    if (segment_length == 0 || (segment_length == 1 && path_p[segment_start] == '.'))
+    {
+      continue;
+    }
+
+    if (segment_length == 2 && path_p[segment_start] == '.' && path_p[segment_start + 1] == '.')
+    {
+      /* Pop the previous component, stopping at the root. */
+      while (out_length > 0 && out_p[out_length - 1] != '/')
+      {
+        out_length--;
+      }
+
+      if (out_length > 0)
+      {
+        out_length--;
+      }
+
+      continue;
+    }
+
+    out_p[out_length++] = '/';
+    memcpy (out_p + out_length, path_p + segment_start, segment_length);
+    out_length += segment_length;
+  }
+
+  if (out_length == 0)
+  {
+    out_p[out_length++] = '/';
+  }
+
+  out_p[out_length] = '\0';
+  *out_length_p = out_length;
+
+  return out_p;
+} /* jerry_port_canonicalize_path */
+
+#endif /* defined(__unix__) || defined(__APPLE__) */
+
+/**
+ * Growable scratch buffer reused across path concatenations.
+ */
+typedef struct
+{
+  char *buffer_p; /**< scratch storage, NULL until the first oversized path */
+  size_t capacity; /**< size of the scratch storage in bytes */
+} jerry_port_scratch_t;
+
+/**
+ * Ensures the scratch buffer can hold the requested number of bytes,
+ * growing it to the next power of two when it cannot.
+ *
+ * The stored bytes are transient, so growing does not preserve them.
+ *
+ * @return pointer to the scratch storage if successful, NULL otherwise
+ */
+static char *
+jerry_port_scratch_reserve (jerry_port_scratch_t *scratch_p, /**< scratch buffer */
+                            size_t size) /**< requested size in bytes */
+{
+  if (size <= scratch_p->capacity)
+  {
+    return scratch_p->buffer_p;
+  }
+
+  size_t capacity = (scratch_p->capacity > 0) ? scratch_p->capacity : (size_t) PATH_MAX;
+
+  while (capacity < size)
+  {
+    capacity *= 2;
+  }
+
+  char *buffer_p = (char *) malloc (capacity);
+
+  if (buffer_p == NULL)
+  {
+    return NULL;
+  }
+
+  free (scratch_p->buffer_p);
+  scratch_p->buffer_p = buffer_p;
+  scratch_p->capacity = capacity;
+
+  return buffer_p;
+} /* jerry_port_scratch_reserve */
+
+/**
+ * Normalize a file path.
+ *
+ * The length of the normalized path is known on every exit path, so the end of
+ * its directory part is computed here as well, saving the caller a rescan.
+ *
+ * @return a newly allocated buffer with the normalized path if the operation is successful,
+ *         NULL otherwise
+ */
+static jerry_char_t *
+jerry_port_normalize_path (jerry_port_scratch_t *scratch_p, /**< scratch buffer for the concatenation */
+                           const jerry_char_t *in_path_p, /**< path to the referenced module */
+                           size_t in_path_length, /**< length of the path */
+                           const jerry_char_t *base_path_p, /**< base path */
+                           size_t base_path_length, /**< length of the base path */
+                           size_t *out_length_p, /**< [out] length of the normalized path */
+                           size_t *dir_end_p) /**< [out] end of the directory part of the normalized path */
+{
+  char stack_buffer[PATH_MAX];
+  char *path_p = stack_buffer;
+  size_t path_length = base_path_length + in_path_length;
+
+  if (path_length >= sizeof (stack_buffer))
+  {
+    path_p = jerry_port_scratch_reserve (scratch_p, path_length + 1);
+
+    if (path_p == NULL)
+    {
+      return NULL;
+    }
+  }
+
+  if (base_path_length > 0)
+  {
+    memcpy (path_p, base_path_p, base_path_length);
+  }
+
+  memcpy (path_p + base_path_length, in_path_p, in_path_length);
+  path_p[path_length] = '\0';
+
+#if defined(_WIN32)
+  char full_path[_MAX_PATH];
+  char *norm_p = NULL;
+  size_t norm_length = 0;
+
+  if (_fullpath (full_path, path_p, _MAX_PATH) != NULL)
+  {
+    norm_length = strlen (full_path);
+
+    norm_p = (char *) malloc (norm_length + 1);
+
+    if (norm_p != NULL)
+    {
+      memcpy (norm_p, full_path, norm_length + 1);
+    }
+  }
+#elif defined(__unix__) || defined(__APPLE__)
+  char *norm_p;
+  size_t norm_length = 0;
+
+  if (jerry_port_path_is_plain_ascii (path_p, path_length))
+  {
+    /* Common case: an absolute ASCII path joined from a previously resolved
+     * base can be canonicalized lexically, without the per-component stat
+     * calls done by realpath. */
+    norm_p = jerry_port_canonicalize_path (path_p, path_length, &norm_length);
+  }
+  else
+  {
+    norm_p = realpath (path_p, NULL);
+    norm_length = (norm_p != NULL) ? strlen (norm_p) : 0;
+  }
+#else /* !defined(_WIN32) && !defined(__unix__) && !defined(__APPLE__) */
+  char *norm_p = NULL;
+  size_t norm_length = 0;
+#endif /* _WIN32 */
+
+  if (norm_p != NULL)
+  {
+    *out_length_p = norm_length;
+    *dir_end_p = jerry_port_get_directory_end ((const jerry_char_t *) norm_p, norm_length);
+    return (jerry_char_t *) norm_p;
+  }
+
+  /* Normalization failed: return a caller-owned copy of the concatenated path. */
+  *out_length_p = path_length;
+  *dir_end_p = jerry_port_get_directory_end ((const jerry_char_t *) path_p, path_length);
+
+  norm_p = (char *) malloc (path_length + 1);
+
+  if (norm_p != NULL)
+  {
+    memcpy (norm_p, path_p, path_length + 1);
+  }
+
+  return (jerry_char_t *) norm_p;
+} /* jerry_port_normalize_path */
+
+/**
+ * A module descriptor.
+ */
+typedef struct jerry_port_module_t
+{
+  size_t base_path_length; /**< base path length for relative difference */
+  size_t path_length; /**< length of the path */
+  uint64_t path_hash; /**< hash of the path, used as module table key */
+  jerry_value_t realm; /**< the realm of the module */
+  jerry_value_t module; /**< the module itself */
+  jerry_char_t path[]; /**< path to the module, co-located with the descriptor */
+} jerry_port_module_t;
+
+/**
+ * Native info descriptor for modules.
+ */
+static const jerry_object_native_info_t jerry_port_module_native_info = {
+  .free_cb = NULL,
+};
+
+/**
+ * An open-addressed module table slot.
+ *
+ * The slot mirrors the lookup keys of the descriptor, so probing only loads
+ * this compact record; the descriptor itself is touched for the final strcmp
+ * and on hits.
+ */
+typedef struct
+{
+  uint64_t hash; /**< cached path hash of the module, checked before strcmp */
+  jerry_value_t realm; /**< cached realm of the module, compared but not owned */
+  jerry_port_module_t *module_p; /**< module descriptor, NULL or tombstone if the slot is unused */
+} jerry_port_module_entry_t;
+
+/**
+ * Marks a module table slot whose module has been released.
+ */
+#define JERRY_PORT_MODULE_TOMBSTONE ((jerry_port_module_t *) 1)
+
+/**
+ * Initial capacity of the module table, must be a power of two.
+ */
+#define JERRY_PORT_MODULE_TABLE_INITIAL_CAPACITY 8
+
+/**
+ * Usable bytes in one module arena page.
+ */
+#define JERRY_PORT_MODULE_ARENA_PAGE_SIZE (64 * 1024)
+
+/**
+ * A page of a module arena.
+ */
+typedef struct jerry_port_module_arena_page_t
+{
+  struct jerry_port_module_arena_page_t *next_p; /**< next page */
+  size_t used; /**< bytes handed out from data */
+  size_t size; /**< usable bytes in data */
+  uint8_t data[]; /**< storage the descriptors are bump-allocated from */
+} jerry_port_module_arena_page_t;
+
+/**
+ * A bump arena holding the module descriptors of one realm.
+ *
+ * Descriptors are never freed individually: releasing the realm's modules
+ * returns the whole page list in one sweep.
+ */
+typedef struct jerry_port_module_arena_t
+{
+  struct jerry_port_module_arena_t *next_p; /**< next arena */
+  jerry_value_t realm; /**< realm the arena serves, compared but not owned */
+  jerry_port_module_arena_page_t *pages_p; /**< pages of the arena */
+} jerry_port_module_arena_t;
+
+/**
+ * A specifier cache slot, mapping (referrer, specifier) pairs to resolved modules.
+ */
+typedef struct
+{
+  uint64_t hash; /**< combined hash of the referrer and the specifier */
+  jerry_port_module_t *referrer_p; /**< referrer module descriptor, NULL for top-level imports */
+  jerry_value_t realm; /**< realm the resolution happened in, compared but not owned */
+  jerry_char_t *specifier_p; /**< copy of the specifier, NULL if the slot is unused */
+  jerry_port_module_t *module_p; /**< resolved module descriptor */
+} jerry_port_specifier_entry_t;
+
+/**
+ * Default module manager.
+ */
+typedef struct
+{
+  jerry_port_module_entry_t *entries_p; /**< module table slots */
+  size_t count; /**< number of live modules in the table */
+  size_t occupied; /**< number of live and tombstoned slots */
+  size_t capacity; /**< number of slots, always a power of two */
+  jerry_port_module_t **visit_order_p; /**< dense array of live modules, rebuilt lazily after changes */
+  jerry_port_module_arena_t *arenas_p; /**< per-realm arenas the module descriptors live in */
+  jerry_port_specifier_entry_t *specifier_entries_p; /**< specifier cache slots */
+  size_t specifier_count; /**< number of live entries in the specifier cache */
+  size_t specifier_capacity; /**< number of specifier cache slots, always a power of two */
+  jerry_port_scratch_t scratch; /**< scratch buffer reused for oversized path concatenations */
+} jerry_port_module_manager_t;
+
+/**
+ * Allocates memory for a module descriptor from the arena of the given realm.
+ *
+ * @return pointer to the allocation if successful, NULL otherwise
+ */
+static void *
+jerry_port_module_arena_alloc (jerry_port_module_manager_t *manager_p, /**< module manager */
+                               const jerry_value_t realm, /**< realm the descriptor belongs to */
+                               size_t size) /**< requested size */
+{
+  jerry_port_module_arena_t *arena_p = manager_p->arenas_p;
+
+  while (arena_p != NULL && arena_p->realm != realm)
+  {
+    arena_p = arena_p->next_p;
+  }
+
+  if (arena_p == NULL)
+  {
+    arena_p = (jerry_port_module_arena_t *) malloc (sizeof (jerry_port_module_arena_t));
+
+    if (arena_p == NULL)
+    {
+      return NULL;
+    }
+
+    arena_p->realm = realm;
+    arena_p->pages_p = NULL;
+    arena_p->next_p = manager_p->arenas_p;
+    manager_p->arenas_p = arena_p;
+  }
+
+  /* Keep every allocation aligned for the descriptor fields. */
+  size = (size + 7) & ~(size_t) 7;
+
+  jerry_port_module_arena_page_t *page_p = arena_p->pages_p;
+
+  if (page_p == NULL || page_p->used + size > page_p->size)
+  {
+    size_t data_size = JERRY_PORT_MODULE_ARENA_PAGE_SIZE;
+
+    if (size > data_size)
+    {
+      data_size = size;
+    }
+
+    page_p = (jerry_port_module_arena_page_t *) malloc (sizeof (jerry_port_module_arena_page_t) + data_size);
+
+    if (page_p == NULL)
+    {
+      return NULL;
+    }
+
+    page_p->used = 0;
+    page_p->size = data_size;
+    page_p->next_p = arena_p->pages_p;
+    arena_p->pages_p = page_p;
+  }
+
+  void *result_p = page_p->data + page_p->used;
+  page_p->used += size;
+
+  return result_p;
+} /* jerry_port_module_arena_alloc */
+
+/**
+ * Returns the pages of the matching arenas to the system in one sweep.
+ */
+static void
+jerry_port_module_arena_release (jerry_port_module_manager_t *manager_p, /**< module manager */
+                                 const jerry_value_t realm, /**< realm whose arena should be released */
+                                 bool release_all) /**< release the arenas of every realm */
+{
+  jerry_port_module_arena_t **link_p = &manager_p->arenas_p;
+
+  while (*link_p != NULL)
+  {
+    jerry_port_module_arena_t *arena_p = *link_p;
+
+    if (release_all || arena_p->realm == realm)
+    {
+      jerry_port_module_arena_page_t *page_p = arena_p->pages_p;
+
+      while (page_p != NULL)
+      {
+        jerry_port_module_arena_page_t *next_p = page_p->next_p;
+        free (page_p);
+        page_p = next_p;
+      }
+
+      *link_p = arena_p->next_p;
+      free (arena_p);
+    }
+    else
+    {
+      link_p = &arena_p->next_p;
+    }
+  }
+} /* jerry_port_module_arena_release */
+
+/**
+ * Computes the FNV-1a hash of a zero terminated path.
+ *
+ * @return 64-bit hash of the path
+ */
+static uint64_t
+jerry_port_module_hash (const jerry_char_t *path_p) /**< path */
+{
+  uint64_t hash = 14695981039346656037ull;
+
+  while (*path_p != '\0')
+  {
+    hash = (hash ^ *path_p++) * 1099511628211ull;
+  }
+
+  return hash;
+} /* jerry_port_module_hash */
+
+/**
+ * Finds a registered module by its realm and normalized path.
+ *
+ * @return the module descriptor if it is registered, NULL otherwise
+ */
+static jerry_port_module_t *
+jerry_port_module_find (jerry_port_module_manager_t *manager_p, /**< module manager */
+                        uint64_t hash, /**< hash of the path */
+                        const jerry_value_t realm, /**< realm of the module */
+                        const jerry_char_t *path_p) /**< normalized path */
+{
+  if (manager_p->capacity == 0)
+  {
+    return NULL;
+  }
+
+  size_t mask = manager_p->capacity - 1;
+
+  for (size_t index = (size_t) hash & mask;; index = (index + 1) & mask)
+  {
+    jerry_port_module_entry_t *entry_p = manager_p->entries_p + index;
+
+    if (entry_p->module_p == NULL)
+    {
+      return NULL;
+    }
+
+    if (entry_p->module_p != JERRY_PORT_MODULE_TOMBSTONE && entry_p->hash == hash && entry_p->realm == realm
+        && strcmp ((const char *) entry_p->module_p->path, (const char *) path_p) == 0)
+    {
+      return entry_p->module_p;
+    }
+  }
+} /* jerry_port_module_find */
+
 /**
- * Determines the size of the given file.
- * @return size of the file
+ * Rebuilds the module table without tombstones in a table of the given capacity.
+ *
+ * @return true if the table was rebuilt,
+ *         false if the new table could not be allocated (the old one is kept)
+ */
+static bool
+jerry_port_module_rehash (jerry_port_module_manager_t *manager_p, /**< module manager */
+                          size_t new_capacity) /**< number of slots of the new table, a power of two */
+{
+  jerry_port_module_entry_t *new_entries_p;
+  new_entries_p = (jerry_port_module_entry_t *) calloc (new_capacity, sizeof (jerry_port_module_entry_t));
+
+  if (new_entries_p == NULL)
+  {
+    return false;
+  }
+
+  size_t new_mask = new_capacity - 1;
+
+  for (size_t i = 0; i < manager_p->capacity; i++)
+  {
+    jerry_port_module_t *old_module_p = manager_p->entries_p[i].module_p;
+
+    if (old_module_p == NULL || old_module_p == JERRY_PORT_MODULE_TOMBSTONE)
+    {
+      continue;
+    }
+
+    size_t index = (size_t) old_module_p->path_hash & new_mask;
+
+    while (new_entries_p[index].module_p != NULL)
+    {
+      index = (index + 1) & new_mask;
+    }
+
+    new_entries_p[index].hash = old_module_p->path_hash;
+    new_entries_p[index].realm = old_module_p->realm;
+    new_entries_p[index].module_p = old_module_p;
+  }
+
+  free (manager_p->entries_p);
+  manager_p->entries_p = new_entries_p;
+  manager_p->capacity = new_capacity;
+  manager_p->occupied = manager_p->count;
+  return true;
+} /* jerry_port_module_rehash */
+
+/**
+ * Computes the table capacity suited to the current number of live modules.
+ *
+ * @return capacity the module table should be rebuilt with
  */
 static size_t
-jerry_port_get_file_size (FILE *file_p) /**< opened file */
+jerry_port_module_table_capacity (size_t count) /**< number of live modules */
 {
-  fseek (file_p, 0, SEEK_END);
-  long size = ftell (file_p);
-  fseek (file_p, 0, SEEK_SET);
+  size_t capacity = JERRY_PORT_MODULE_TABLE_INITIAL_CAPACITY;
 
-  return (size_t) size;
-} /* jerry_port_get_file_size */
+  while (capacity < (count + 1) * 2)
+  {
+    capacity *= 2;
+  }
+
+  return capacity;
+} /* jerry_port_module_table_capacity */
 
 /**
- * Opens file with the given path and reads its source.
- * @return the source of the file
+ * Inserts a module descriptor into the module table, growing it if necessary.
+ *
+ * @return true if the descriptor was inserted,
+ *         false if the table could not grow and has no slot left
  */
-uint8_t *
-jerry_port_read_source (const char *file_name_p, /**< file name */
-                        size_t *out_size_p) /**< [out] read bytes */
+static bool
+jerry_port_module_insert (jerry_port_module_manager_t *manager_p, /**< module manager */
+                          jerry_port_module_t *module_p) /**< module descriptor */
 {
-  struct stat stat_buffer;
-  if (stat (file_name_p, &stat_buffer) == -1 || S_ISDIR (stat_buffer.st_mode))
+  if ((manager_p->occupied + 1) * 4 > manager_p->capacity * 3
+      && !jerry_port_module_rehash (manager_p, jerry_port_module_table_capacity (manager_p->count))
+      && manager_p->count >= manager_p->capacity)
   {
-    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to open file: %s\n", file_name_p);
-    return NULL;
+    /* The table could not grow and every slot holds a live module. */
+    return false;
   }
 
-  FILE *file_p = fopen (file_name_p, "rb");
+  size_t mask = manager_p->capacity - 1;
+  size_t index = (size_t) module_p->path_hash & mask;
 
-  if (file_p == NULL)
+  while (manager_p->entries_p[index].module_p != NULL
+         && manager_p->entries_p[index].module_p != JERRY_PORT_MODULE_TOMBSTONE)
   {
-    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to open file: %s\n", file_name_p);
-    return NULL;
+    index = (index + 1) & mask;
   }
 
-  size_t file_size = jerry_port_get_file_size (file_p);
-  uint8_t *buffer_p = (uint8_t *) malloc (file_size);
+  if (manager_p->entries_p[index].module_p == NULL)
+  {
+    manager_p->occupied++;
+  }
 
-  if (buffer_p == NULL)
+  manager_p->entries_p[index].hash = module_p->path_hash;
+  manager_p->entries_p[index].realm = module_p->realm;
+  manager_p->entries_p[index].module_p = module_p;
+  manager_p->count++;
+
+  free (manager_p->visit_order_p);
+  manager_p->visit_order_p = NULL;
+  return true;
+} /* jerry_port_module_insert */
+
+/**
+ * Makes sure the dense visitation order of the module table is available.
+ *
+ * The table slots are mostly empty at the usual load factor; walking a compact
+ * pointer array instead visits only live modules, in contiguous memory.
+ */
+static void
+jerry_port_module_ensure_visit_order (jerry_port_module_manager_t *manager_p) /**< module manager */
+{
+  if (manager_p->visit_order_p != NULL || manager_p->count == 0)
   {
-    fclose (file_p);
+    return;
+  }
 
-    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to allocate memory for file: %s\n", file_name_p);
-    return NULL;
+  jerry_port_module_t **visit_p = (jerry_port_module_t **) malloc (manager_p->count * sizeof (jerry_port_module_t *));
+
+  if (visit_p == NULL)
+  {
+    return;
   }
 
-  size_t bytes_read = fread (buffer_p, 1u, file_size, file_p);
+  size_t visit_index = 0;
 
-  if (bytes_read != file_size)
+  for (size_t i = 0; i < manager_p->capacity; i++)
   {
-    fclose (file_p);
-    free (buffer_p);
+    jerry_port_module_t *module_p = manager_p->entries_p[i].module_p;
 
-    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to read file: %s\n", file_name_p);
-    return NULL;
+    if (module_p != NULL && module_p != JERRY_PORT_MODULE_TOMBSTONE)
+    {
+      visit_p[visit_index++] = module_p;
+    }
   }
 
-  fclose (file_p);
-  *out_size_p = bytes_read;
+  manager_p->visit_order_p = visit_p;
+} /* jerry_port_module_ensure_visit_order */
 
-  return buffer_p;
-} /* jerry_port_read_source */
+/**
+ * Tombstones the module table slot of the given module.
+ */
+static void
+jerry_port_module_remove_slot (jerry_port_module_manager_t *manager_p, /**< module manager */
+                               const jerry_port_module_t *module_p) /**< module descriptor to remove */
+{
+  size_t mask = manager_p->capacity - 1;
+
+  for (size_t index = (size_t) module_p->path_hash & mask;; index = (index + 1) & mask)
+  {
+    if (manager_p->entries_p[index].module_p == module_p)
+    {
+      manager_p->entries_p[index].module_p = JERRY_PORT_MODULE_TOMBSTONE;
+      return;
+    }
+  }
+} /* jerry_port_module_remove_slot */
 
 /**
- * Release the previously opened file's content.
+ * Computes the specifier cache key for a specifier resolved against a referrer in a realm.
+ *
+ * @return 64-bit hash of the (referrer, realm, specifier) triple
  */
-void
-jerry_port_release_source (uint8_t *buffer_p) /**< buffer to free */
+static uint64_t
+jerry_port_specifier_hash (const jerry_port_module_t *referrer_p, /**< referrer module descriptor */
+                           const jerry_value_t realm, /**< current realm */
+                           const jerry_char_t *specifier_p) /**< specifier */
 {
-  free (buffer_p);
-} /* jerry_port_release_source */
+  uint64_t hash = jerry_port_module_hash (specifier_p);
+
+  hash = (hash ^ (uint64_t) (uintptr_t) referrer_p) * 1099511628211ull;
+  hash = (hash ^ realm) * 1099511628211ull;
+
+  return hash;
+} /* jerry_port_specifier_hash */
 
 /**
- * Computes the end of the directory part of a path.
+ * Looks up a previously resolved (referrer, specifier) pair in the specifier cache.
  *
- * @return end of the directory part of a path.
+ * A hit resolves the import without path normalization, so repeated imports of
+ * the same specifier skip the realpath syscalls entirely.
+ *
+ * @return the resolved module descriptor if the pair is cached, NULL otherwise
  */
-static size_t
-jerry_port_get_directory_end (const jerry_char_t *path_p) /**< path */
+static jerry_port_module_t *
+jerry_port_specifier_cache_find (jerry_port_module_manager_t *manager_p, /**< module manager */
+                                 uint64_t hash, /**< specifier cache key */
+                                 const jerry_port_module_t *referrer_p, /**< referrer module descriptor */
+                                 const jerry_value_t realm, /**< current realm */
+                                 const jerry_char_t *specifier_p) /**< specifier */
 {
-  const jerry_char_t *end_p = path_p + strlen ((const char *) path_p);
+  if (manager_p->specifier_capacity == 0)
+  {
+    return NULL;
+  }
+
+  size_t mask = manager_p->specifier_capacity - 1;
 
-  while (end_p > path_p)
+  for (size_t index = (size_t) hash & mask;; index = (index + 1) & mask)
   {
-#if defined(_WIN32)
-    if (end_p[-1] == '/' || end_p[-1] == '\\')
+    jerry_port_specifier_entry_t *entry_p = manager_p->specifier_entries_p + index;
+
+    if (entry_p->specifier_p == NULL)
     {
-      return (size_t) (end_p - path_p);
+      return NULL;
     }
-#else /* !_WIN32 */
-    if (end_p[-1] == '/')
+
+    if (entry_p->hash == hash && entry_p->referrer_p == referrer_p && entry_p->realm == realm
+        && strcmp ((const char *) entry_p->specifier_p, (const char *) specifier_p) == 0)
     {
-      return (size_t) (end_p - path_p);
+      return entry_p->module_p;
     }
-#endif /* _WIN32 */
-
-    end_p--;
   }
-
-  return 0;
-} /* jerry_port_get_directory_end */
+} /* jerry_port_specifier_cache_find */
 
 /**
- * Normalize a file path.
- *
- * @return a newly allocated buffer with the normalized path if the operation is successful,
- *         NULL otherwise
+ * Caches the module a (referrer, specifier) pair resolved to.
  */
-static jerry_char_t *
-jerry_port_normalize_path (const jerry_char_t *in_path_p, /**< path to the referenced module */
-                           size_t in_path_length, /**< length of the path */
-                           const jerry_char_t *base_path_p, /**< base path */
-                           size_t base_path_length) /**< length of the base path */
+static void
+jerry_port_specifier_cache_insert (jerry_port_module_manager_t *manager_p, /**< module manager */
+                                   uint64_t hash, /**< specifier cache key */
+                                   jerry_port_module_t *referrer_p, /**< referrer module descriptor */
+                                   const jerry_value_t realm, /**< current realm */
+                                   const jerry_char_t *specifier_p, /**< specifier */
+                                   size_t specifier_length, /**< length of the specifier */
+                                   jerry_port_module_t *module_p) /**< resolved module descriptor */
 {
-  char *path_p;
+  jerry_char_t *specifier_copy_p = (jerry_char_t *) malloc (specifier_length + 1);
 
-  if (base_path_length > 0)
+  if (specifier_copy_p == NULL)
   {
-    path_p = (char *) malloc (base_path_length + in_path_length + 1);
+    return;
+  }
 
-    if (path_p == NULL)
+  memcpy (specifier_copy_p, specifier_p, specifier_length + 1);
+
+  if ((manager_p->specifier_count + 1) * 4 > manager_p->specifier_capacity * 3)
+  {
+    size_t new_capacity = JERRY_PORT_MODULE_TABLE_INITIAL_CAPACITY;
+
+    while (new_capacity < (manager_p->specifier_count + 1) * 2)
     {
-      return NULL;
+      new_capacity *= 2;
     }
 
-    memcpy (path_p, base_path_p, base_path_length);
-    memcpy (path_p + base_path_length, in_path_p, in_path_length);
-    path_p[base_path_length + in_path_length] = '\0';
-  }
-  else
-  {
-    path_p = (char *) malloc (in_path_length + 1);
+    jerry_port_specifier_entry_t *new_entries_p;
+    new_entries_p = (jerry_port_specifier_entry_t *) calloc (new_capacity, sizeof (jerry_port_specifier_entry_t));
 
-    if (path_p == NULL)
+    if (new_entries_p == NULL)
     {
-      return NULL;
+      /* The cache only speeds up repeat imports: skip caching this one. */
+      free (specifier_copy_p);
+      return;
     }
 
-    memcpy (path_p, in_path_p, in_path_length);
-    path_p[in_path_length] = '\0';
-  }
+    size_t new_mask = new_capacity - 1;
 
-#if defined(_WIN32)
-  char full_path[_MAX_PATH];
+    for (size_t i = 0; i < manager_p->specifier_capacity; i++)
+    {
+      jerry_port_specifier_entry_t *old_entry_p = manager_p->specifier_entries_p + i;
 
-  if (_fullpath (full_path, path_p, _MAX_PATH) != NULL)
-  {
-    free (path_p);
+      if (old_entry_p->specifier_p == NULL)
+      {
+        continue;
+      }
 
-    size_t full_path_len = strlen (full_path);
+      size_t index = (size_t) old_entry_p->hash & new_mask;
 
-    path_p = (char *) malloc (full_path_len + 1);
+      while (new_entries_p[index].specifier_p != NULL)
+      {
+        index = (index + 1) & new_mask;
+      }
 
-    if (path_p == NULL)
-    {
-      return NULL;
+      new_entries_p[index] = *old_entry_p;
     }
 
-    memcpy (path_p, full_path, full_path_len + 1);
+    free (manager_p->specifier_entries_p);
+    manager_p->specifier_entries_p = new_entries_p;
+    manager_p->specifier_capacity = new_capacity;
   }
-#elif defined(__unix__) || defined(__APPLE__)
-  char *norm_p = realpath (path_p, NULL);
 
-  if (norm_p != NULL)
+  size_t mask = manager_p->specifier_capacity - 1;
+  size_t index = (size_t) hash & mask;
+
+  while (manager_p->specifier_entries_p[index].specifier_p != NULL)
   {
-    free (path_p);
-    path_p = norm_p;
+    index = (index + 1) & mask;
   }
-#endif /* _WIN32 */
 
-  return (jerry_char_t *) path_p;
-} /* jerry_port_normalize_path */
+  jerry_port_specifier_entry_t *entry_p = manager_p->specifier_entries_p + index;
+  entry_p->hash = hash;
+  entry_p->referrer_p = referrer_p;
+  entry_p->realm = realm;
+  entry_p->specifier_p = specifier_copy_p;
+  entry_p->module_p = module_p;
+  manager_p->specifier_count++;
+} /* jerry_port_specifier_cache_insert */
 
 /**
- * A module descriptor.
+ * Drops every entry of the specifier cache.
+ *
+ * Called whenever modules are released, so cache entries never outlive the
+ * descriptors they point to.
  */
-typedef struct jerry_port_module_t
+static void
+jerry_port_specifier_cache_clear (jerry_port_module_manager_t *manager_p) /**< module manager */
 {
-  struct jerry_port_module_t *next_p; /**< next_module */
-  jerry_char_t *path_p; /**< path to the module */
-  size_t base_path_length; /**< base path length for relative difference */
-  jerry_value_t realm; /**< the realm of the module */
-  jerry_value_t module; /**< the module itself */
-} jerry_port_module_t;
+  for (size_t i = 0; i < manager_p->specifier_capacity; i++)
+  {
+    free (manager_p->specifier_entries_p[i].specifier_p);
+  }
 
-/**
- * Native info descriptor for modules.
- */
-static const jerry_object_native_info_t jerry_port_module_native_info = {
-  .free_cb = NULL,
-};
+  free (manager_p->specifier_entries_p);
+  manager_p->specifier_entries_p = NULL;
+  manager_p->specifier_count = 0;
+  manager_p->specifier_capacity = 0;
+} /* jerry_port_specifier_cache_clear */
+
+#if defined(_POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0)
 
 /**
- * Default module manager.
+ * Starts background readahead for the import requests of a freshly parsed module.
+ *
+ * The files the module imports are read by the resolve calls that follow, so
+ * advising the kernel now overlaps their disk reads with the parsing and
+ * resolution work done in between. Purely a hint: failures are ignored and the
+ * regular resolve path remains responsible for actually loading the files.
  */
-typedef struct
+static void
+jerry_port_module_prefetch_requests (const jerry_value_t module, /**< parsed module */
+                                     const jerry_char_t *base_path_p, /**< base path of the module */
+                                     size_t base_path_length) /**< length of the base path */
 {
-  jerry_port_module_t *module_head_p; /**< first module */
-} jerry_port_module_manager_t;
+  size_t request_count = jerry_module_request_count (module);
+
+  for (size_t i = 0; i < request_count; i++)
+  {
+    jerry_value_t request = jerry_module_request (module, i);
+
+    if (jerry_value_is_string (request))
+    {
+      char path_buffer[PATH_MAX];
+      jerry_size_t specifier_size = jerry_string_size (request, JERRY_ENCODING_UTF8);
+
+      if (base_path_length + specifier_size < sizeof (path_buffer))
+      {
+        memcpy (path_buffer, base_path_p, base_path_length);
+        jerry_string_to_buffer (request,
+                                JERRY_ENCODING_UTF8,
+                                (jerry_char_t *) path_buffer + base_path_length,
+                                specifier_size);
+        path_buffer[base_path_length + specifier_size] = '\0';
+
+        int fd = open (path_buffer, O_RDONLY | O_CLOEXEC);
+
+        if (fd != -1)
+        {
+          posix_fadvise (fd, 0, 0, POSIX_FADV_WILLNEED);
+          close (fd);
+        }
+      }
+    }
+
+    jerry_value_free (request);
+  }
+} /* jerry_port_module_prefetch_requests */
+
+#endif /* defined(_POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0) */
 
 /**
  * Release known modules.
@@ -237,39 +1251,86 @@ jerry_port_module_free (jerry_port_module_manager_t *manager_p, /**< module mana
                         const jerry_value_t realm) /**< if this argument is object, release only those modules,
                                                     *   which realm value is equal to this argument. */
 {
-  jerry_port_module_t *module_p = manager_p->module_head_p;
-
   bool release_all = !jerry_value_is_object (realm);
 
-  jerry_port_module_t *prev_p = NULL;
+  if (manager_p->count > 0)
+  {
+    jerry_port_specifier_cache_clear (manager_p);
+    jerry_port_module_ensure_visit_order (manager_p);
+  }
 
-  while (module_p != NULL)
+  if (manager_p->visit_order_p != NULL)
   {
-    jerry_port_module_t *next_p = module_p->next_p;
+    size_t live_count = 0;
 
-    if (release_all || module_p->realm == realm)
+    for (size_t i = 0; i < manager_p->count; i++)
     {
-      free (module_p->path_p);
-      jerry_value_free (module_p->realm);
-      jerry_value_free (module_p->module);
-
-      free (module_p);
+      jerry_port_module_t *module_p = manager_p->visit_order_p[i];
 
-      if (prev_p == NULL)
+      if (release_all || module_p->realm == realm)
       {
-        manager_p->module_head_p = next_p;
+        if (!release_all)
+        {
+          jerry_port_module_remove_slot (manager_p, module_p);
+        }
+
+        jerry_value_free (module_p->realm);
+        jerry_value_free (module_p->module);
       }
       else
       {
-        prev_p->next_p = next_p;
+        /* Compacting in place keeps the visitation order valid. */
+        manager_p->visit_order_p[live_count++] = module_p;
       }
     }
-    else
+
+    manager_p->count = live_count;
+  }
+  else
+  {
+    /* The visitation order could not be allocated: sweep the slots. */
+    for (size_t i = 0; i < manager_p->capacity; i++)
     {
-      prev_p = module_p;
+      jerry_port_module_t *module_p = manager_p->entries_p[i].module_p;
+
+      if (module_p == NULL || module_p == JERRY_PORT_MODULE_TOMBSTONE)
+      {
+        continue;
+      }
+
+      if (release_all || module_p->realm == realm)
+      {
+        jerry_value_free (module_p->realm);
+        jerry_value_free (module_p->module);
+
+        manager_p->entries_p[i].module_p = JERRY_PORT_MODULE_TOMBSTONE;
+        manager_p->count--;
+      }
     }
+  }
+
+  jerry_port_module_arena_release (manager_p, realm, release_all);
+
+  if (release_all)
+  {
+    free (manager_p->entries_p);
+    free (manager_p->visit_order_p);
+    free (manager_p->scratch.buffer_p);
+    manager_p->entries_p = NULL;
+    manager_p->visit_order_p = NULL;
+    manager_p->count = 0;
+    manager_p->occupied = 0;
+    manager_p->capacity = 0;
+    manager_p->scratch.buffer_p = NULL;
+    manager_p->scratch.capacity = 0;
+    return;
+  }
 
-    module_p = next_p;
+  /* Second pass: once tombstones occupy more than a quarter of the table,
+   * rebuild it so probe chains stay short. */
+  if (manager_p->capacity > 0 && (manager_p->occupied - manager_p->count) * 4 > manager_p->capacity)
+  {
+    jerry_port_module_rehash (manager_p, jerry_port_module_table_capacity (manager_p->count));
   }
 } /* jerry_port_module_free */
 
@@ -279,7 +1340,7 @@ jerry_port_module_free (jerry_port_module_manager_t *manager_p, /**< module mana
 static void
 jerry_port_module_manager_init (void *user_data_p)
 {
-  ((jerry_port_module_manager_t *) user_data_p)->module_head_p = NULL;
+  memset (user_data_p, 0, sizeof (jerry_port_module_manager_t));
 } /* jerry_port_module_manager_init */
 
 /**
@@ -315,53 +1376,93 @@ jerry_port_module_resolve (const jerry_value_t specifier, /**< module specifier
 
   const jerry_char_t *base_path_p = NULL;
   size_t base_path_length = 0;
-  jerry_port_module_t *module_p = jerry_object_get_native_ptr (referrer, &jerry_port_module_native_info);
+  jerry_port_module_t *referrer_p = jerry_object_get_native_ptr (referrer, &jerry_port_module_native_info);
 
-  if (module_p != NULL)
+  if (referrer_p != NULL)
   {
-    base_path_p = module_p->path_p;
-    base_path_length = module_p->base_path_length;
+    base_path_p = referrer_p->path;
+    base_path_length = referrer_p->base_path_length;
   }
 
   jerry_size_t in_path_length = jerry_string_size (specifier, JERRY_ENCODING_UTF8);
-  jerry_char_t *in_path_p = (jerry_char_t *) malloc (in_path_length + 1);
-  jerry_string_to_buffer (specifier, JERRY_ENCODING_UTF8, in_path_p, in_path_length);
-  in_path_p[in_path_length] = '\0';
+  jerry_char_t specifier_buffer[256];
+  jerry_char_t *heap_specifier_p = NULL;
+  jerry_char_t *in_path_p = specifier_buffer;
 
-  jerry_char_t *path_p = jerry_port_normalize_path (in_path_p, in_path_length, base_path_p, base_path_length);
-
-  if (path_p == NULL)
+  if (in_path_length >= sizeof (specifier_buffer))
   {
-    return jerry_throw_sz (JERRY_ERROR_COMMON, "Out of memory");
+    heap_specifier_p = (jerry_char_t *) malloc (in_path_length + 1);
+
+    if (JERRY_UNLIKELY (heap_specifier_p == NULL))
+    {
+      return jerry_throw_sz (JERRY_ERROR_COMMON, "Out of memory");
+    }
+
+    in_path_p = heap_specifier_p;
   }
 
+  jerry_string_to_buffer (specifier, JERRY_ENCODING_UTF8, in_path_p, in_path_length);
+  in_path_p[in_path_length] = '\0';
+
   jerry_value_t realm = jerry_current_realm ();
 
   jerry_port_module_manager_t *manager_p;
   manager_p = (jerry_port_module_manager_t *) jerry_context_data (&jerry_port_module_manager);
 
-  module_p = manager_p->module_head_p;
+  uint64_t specifier_hash = jerry_port_specifier_hash (referrer_p, realm, in_path_p);
+  jerry_port_module_t *module_p;
+  module_p = jerry_port_specifier_cache_find (manager_p, specifier_hash, referrer_p, realm, in_path_p);
 
-  while (module_p != NULL)
+  /* In steady state the import has been resolved before: the cache hit is the hot path. */
+  if (JERRY_LIKELY (module_p != NULL))
   {
-    if (module_p->realm == realm && strcmp ((const char *) module_p->path_p, (const char *) path_p) == 0)
-    {
-      free (path_p);
-      free (in_path_p);
-      jerry_value_free (realm);
-      return jerry_value_copy (module_p->module);
-    }
+    free (heap_specifier_p);
+    jerry_value_free (realm);
+    return jerry_value_copy (module_p->module);
+  }
+
+  size_t path_length;
+  size_t dir_end;
+  jerry_char_t *path_p = jerry_port_normalize_path (&manager_p->scratch,
+                                                    in_path_p,
+                                                    in_path_length,
+                                                    base_path_p,
+                                                    base_path_length,
+                                                    &path_length,
+                                                    &dir_end);
+
+  if (JERRY_UNLIKELY (path_p == NULL))
+  {
+    free (heap_specifier_p);
+    jerry_value_free (realm);
+    return jerry_throw_sz (JERRY_ERROR_COMMON, "Out of memory");
+  }
 
-    module_p = module_p->next_p;
+  uint64_t path_hash = jerry_port_module_hash (path_p);
+  module_p = jerry_port_module_find (manager_p, path_hash, realm, path_p);
+
+  if (module_p != NULL)
+  {
+    jerry_port_specifier_cache_insert (manager_p,
+                                       specifier_hash,
+                                       referrer_p,
+                                       realm,
+                                       in_path_p,
+                                       in_path_length,
+                                       module_p);
+    free (path_p);
+    free (heap_specifier_p);
+    jerry_value_free (realm);
+    return jerry_value_copy (module_p->module);
   }
 
   size_t source_size;
   uint8_t *source_p = jerry_port_read_source ((const char *) path_p, &source_size);
 
-  if (source_p == NULL)
+  if (JERRY_UNLIKELY (source_p == NULL))
   {
     free (path_p);
-    free (in_path_p);
+    free (heap_specifier_p);
     jerry_value_free (realm);
     /* TODO: This is incorrect, but makes test262 module tests pass
      * (they should throw SyntaxError, but not because the module cannot be found). */
@@ -370,31 +1471,62 @@ jerry_port_module_resolve (const jerry_value_t specifier, /**< module specifier
 
   jerry_parse_options_t parse_options;
   parse_options.options = JERRY_PARSE_MODULE | JERRY_PARSE_HAS_SOURCE_NAME;
-  parse_options.source_name = jerry_string (in_path_p, in_path_length, JERRY_ENCODING_UTF8);
+  /* The specifier is the string the source name was rebuilt from: reference it
+   * instead of re-encoding the UTF-8 bytes into a fresh engine string. */
+  parse_options.source_name = jerry_value_copy (specifier);
 
   jerry_value_t ret_value = jerry_parse (source_p, source_size, &parse_options);
   jerry_value_free (parse_options.source_name);
 
   jerry_port_release_source (source_p);
-  free (in_path_p);
 
   if (jerry_value_is_exception (ret_value))
   {
     free (path_p);
+    free (heap_specifier_p);
     jerry_value_free (realm);
     return ret_value;
   }
 
-  module_p = (jerry_port_module_t *) malloc (sizeof (jerry_port_module_t));
+  module_p = (jerry_port_module_t *) jerry_port_module_arena_alloc (manager_p,
+                                                                    realm,
+                                                                    sizeof (jerry_port_module_t) + path_length + 1);
+
+  if (JERRY_UNLIKELY (module_p == NULL))
+  {
+    jerry_value_free (ret_value);
+    free (path_p);
+    free (heap_specifier_p);
+    jerry_value_free (realm);
+    return jerry_throw_sz (JERRY_ERROR_COMMON, "Out of memory");
+  }
+
+  memcpy (module_p->path, path_p, path_length + 1);
+  free (path_p);
 
-  module_p->next_p = manager_p->module_head_p;
-  module_p->path_p = path_p;
-  module_p->base_path_length = jerry_port_get_directory_end (module_p->path_p);
+  module_p->base_path_length = dir_end;
+  module_p->path_length = path_length;
+  module_p->path_hash = path_hash;
   module_p->realm = realm;
   module_p->module = jerry_value_copy (ret_value);
 
+  if (JERRY_UNLIKELY (!jerry_port_module_insert (manager_p, module_p)))
+  {
+    /* The arena-backed descriptor itself is reclaimed with the realm. */
+    jerry_value_free (module_p->module);
+    jerry_value_free (ret_value);
+    free (heap_specifier_p);
+    jerry_value_free (realm);
+    return jerry_throw_sz (JERRY_ERROR_COMMON, "Out of memory");
+  }
+
   jerry_object_set_native_ptr (ret_value, &jerry_port_module_native_info, module_p);
-  manager_p->module_head_p = module_p;
+  jerry_port_specifier_cache_insert (manager_p, specifier_hash, referrer_p, realm, in_path_p, in_path_length, module_p);
+  free (heap_specifier_p);
+
+#if defined(_POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0)
+  jerry_port_module_prefetch_requests (ret_value, module_p->path, module_p->base_path_length);
+#endif /* defined(_POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0) */
 
   return ret_value;
 } /* jerry_port_module_resolve */
@@ -26,21 +26,70 @@
 #define JERRY_STANDALONE_EXIT_CODE_FAIL (1)
 
 /**
- * Register a JavaScript function in the global object.
+ * Built-in functions registered in the global object on startup.
+ */
+static const struct
+{
+  const char *name_p; /**< name of the function */
+  jerry_external_handler_t handler_p; /**< function callback */
+} builtin_functions[] = {
+  { "print", jerryx_handler_print },
+};
+
+/**
+ * Register the built-in JavaScript functions in the global object.
+ *
+ * The global object is fetched once and every entry of the table is attached
+ * to it directly, instead of going through the per-name helper wrapper.
  */
 static void
-register_js_function (const char *name_p, /**< name of the function */
-                      jerry_external_handler_t handler_p) /**< function callback */
+register_js_functions (void)
 {
-  jerry_value_t result_val = jerryx_handler_register_global (name_p, handler_p);
+  jerry_value_t global_obj_val = jerry_current_realm ();
 
-  if (jerry_value_is_exception (result_val))
+  for (size_t i = 0; i < sizeof (builtin_functions) / sizeof (builtin_functions[0]); i++)
   {
-    jerry_port_log (JERRY_LOG_LEVEL_WARNING, "[Warning] Failed to register '%s' method.", name_p);
+    jerry_value_t name_val = jerry_string_sz (builtin_functions[i].name_p);
+    jerry_value_t function_val = jerry_function_external (builtin_functions[i].handler_p);
+    jerry_value_t result_val = jerry_object_set (global_obj_val, name_val, function_val);
+
+    if (jerry_value_is_exception (result_val))
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_WARNING,
+                      "[Warning] Failed to register '%s' method.",
+                      builtin_functions[i].name_p);
+    }
+
+    jerry_value_free (result_val);
+    jerry_value_free (function_val);
+    jerry_value_free (name_val);
   }
 
-  jerry_value_free (result_val);
-} /* register_js_function */
+  jerry_value_free (global_obj_val);
+} /* register_js_functions */
+
+#if JERRY_SNAPSHOT_EXEC
+/**
+ * Snapshot of the script [print ('Hello, World!');], generated on the host with:
+ *
+ *   jerry-snapshot generate hello.js -o hello.snapshot
+ *
+ * Executing the snapshot skips the lexer and the parser on the device.
+ *
+ * Not const: jerry_exec_snapshot patches literal references in the buffer in
+ * place, so the blob has to live in RAM instead of flash.
+ */
+static uint32_t hello_snapshot[] = {
+  0x5952524a, 0x00000046, 0x00000000, 0x00000040, 0x00000001, 0x00000018, 0x00010005, 0x00023010,
+  0x00000026, 0x03030201, 0x00000007, 0x00000107, 0xd202012d, 0x00000056, 0x00000000, 0x00000307,
+  0x72700005, 0x00746e69, 0x6548000d, 0x2c6f6c6c, 0x726f5720, 0x0021646c, 0x00000000,
+};
+
+/**
+ * Size of the snapshot in bytes, without the alignment padding of the array.
+ */
+#define HELLO_SNAPSHOT_SIZE 90
+#endif /* JERRY_SNAPSHOT_EXEC */
 
 int main()
 {
@@ -51,12 +100,19 @@ int main()
   jerry_init (JERRY_INIT_EMPTY);
 
   jerry_value_t ret_value = jerry_undefined ();
+
+  /* Register the built-in functions in the global object. */
+  register_js_functions ();
+
+#if JERRY_SNAPSHOT_EXEC
+  jerry_port_log (JERRY_LOG_LEVEL_DEBUG, "This test runs a precompiled snapshot of [print ('Hello, World!');]\n\n");
+
+  /* Execute the precompiled script in the Global scope */
+  ret_value = jerry_exec_snapshot (hello_snapshot, HELLO_SNAPSHOT_SIZE, 0, 0, NULL);
+#else /* !JERRY_SNAPSHOT_EXEC */
   const jerry_char_t script[] = "print ('Hello, World!');";
   jerry_port_log (JERRY_LOG_LEVEL_DEBUG, "This test run the following script code: [%s]\n\n", script);
 
-  /* Register the print function in the global object. */
-  register_js_function ("print", jerryx_handler_print);
-
   /* Setup Global scope code */
   ret_value = jerry_parse (script, sizeof (script) - 1, NULL);
 
@@ -65,6 +121,7 @@ int main()
     /* Execute the parsed source code in the Global scope */
     ret_value = jerry_run (ret_value);
   }
+#endif /* JERRY_SNAPSHOT_EXEC */
 
   int ret_code = JERRY_STANDALONE_EXIT_CODE_OK;
 